@@ -6,7 +6,7 @@
 #include <TLine.h>
 
 // CMS Lumi Text - CMS는 왼쪽 위, Preliminary는 그 아래, 루미노시티는 오른쪽 위에 표시
-void CMS_lumi(TPad* pad, const char* extraText = "Preliminary", const char* lumiText = "13 TeV") {
+static void CMS_lumi(TPad* pad, const char* extraText = "Preliminary", const char* lumiText = "13 TeV") {
     TLatex* latex = new TLatex();
     latex->SetNDC();
     latex->SetTextAngle(0);
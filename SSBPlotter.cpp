@@ -0,0 +1,562 @@
+#include <TH1.h>
+#include <THStack.h>
+#include <TCanvas.h>
+#include <TLegend.h>
+#include <TColor.h>
+#include <TSystem.h>
+#include <TStyle.h>
+#include <TROOT.h>
+#include <TPad.h>
+#include <TLine.h>
+#include <TLatex.h>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <algorithm>
+
+#include "SSBPlotter.h"
+
+// Include external header files
+#include "tdrstyle.h"
+#include "CMS_lumi.h"
+
+namespace ssb {
+
+// Function to parse the color configuration
+std::map<std::string, int> loadColorConfig(const std::string &colorConfigFile) {
+    std::map<std::string, int> colorMap;
+    std::ifstream infile(colorConfigFile);
+    if (!infile.is_open()) {
+        std::cerr << "Error: Could not open color config file." << std::endl;
+        return colorMap;
+    }
+
+    std::string line;
+    while (std::getline(infile, line)) {
+        std::istringstream iss(line);
+        std::string sampleName, colorName;
+        int colorOffset;
+        char plusSign;
+        if (!(iss >> sampleName >> colorName >> plusSign >> colorOffset) || plusSign != '+') {
+            std::cerr << "Error: Invalid format in color config file: " << line << std::endl;
+            continue;
+        }
+        std::cout << "sampleName : " << sampleName << " colorName : " << colorName << " colorOffset : " << colorOffset << std::endl;
+        int color = kBlack; // default color
+        if (colorName == "kRed") {
+            color = kRed + colorOffset;
+        } else if (colorName == "kBlue") {
+            color = kBlue + colorOffset;
+        } else if (colorName == "kGreen") {
+            color = kGreen + colorOffset;
+        } else if (colorName == "kMagenta") {
+            color = kMagenta + colorOffset;
+        } else if (colorName == "kYellow") {
+            color = kYellow + colorOffset;
+        } else if (colorName == "kOrange") {
+            color = kOrange + colorOffset;
+        } else if (colorName == "kAzure") {
+            color = kAzure + colorOffset;
+        } // Add more color options as needed
+        std::cout << "color " << color << std::endl;
+        colorMap[sampleName] = color;
+    }
+
+    infile.close();
+    return colorMap;
+}
+
+std::map<std::string, double> loadScaleConfig(const std::string &scaleConfigFile) {
+    std::map<std::string, double> scaleMap;
+    std::ifstream infile(scaleConfigFile);
+    if (!infile.is_open()) {
+        std::cerr << "Error: Could not open scale config file." << std::endl;
+        return scaleMap;
+    }
+
+    std::string line;
+    while (std::getline(infile, line)) {
+        std::istringstream iss(line);
+        std::string sampleName;
+        double scaleValue;
+
+        if (!(iss >> sampleName >> scaleValue)) {
+            std::cerr << "Error: Invalid format in scale config file: " << line << std::endl;
+            continue;
+        }
+
+        std::cout << "sampleName : " << sampleName << " scaleValue : " << scaleValue << std::endl;
+        scaleMap[sampleName] = scaleValue;
+    }
+
+    infile.close();
+    return scaleMap;
+}
+
+std::map<std::string, HistConfig> loadHistConfig(const std::string &histConfigFile) {
+    std::map<std::string, HistConfig> histConfigMap;
+    std::ifstream infile(histConfigFile);
+    if (!infile.is_open()) {
+        std::cerr << "Error: Could not open histogram config file." << std::endl;
+        return histConfigMap;
+    }
+
+    std::string line;
+    while (std::getline(infile, line)) {
+        std::istringstream iss(line);
+        std::string histNamePattern;
+        int rebinFactor;
+        std::string xAxisLabel;
+
+        if (!(iss >> histNamePattern >> rebinFactor)) {
+            std::cerr << "Error: Invalid format in histogram config file: " << line << std::endl;
+            continue;
+        }
+
+        // Read the rest of the line for xAxisLabel
+        std::string restOfLine;
+        std::getline(iss, restOfLine);
+
+        // Remove leading whitespace
+        restOfLine.erase(0, restOfLine.find_first_not_of(" \t"));
+        xAxisLabel = restOfLine;
+
+        // Remove trailing comments if present
+        size_t commentPos = xAxisLabel.find("//");
+        if (commentPos != std::string::npos) {
+            xAxisLabel = xAxisLabel.substr(0, commentPos);
+            // Trim trailing whitespace
+            xAxisLabel.erase(xAxisLabel.find_last_not_of(" \t") + 1);
+        }
+
+        // Process escape sequences
+        std::string processedLabel = "";
+        for (size_t i = 0; i < xAxisLabel.length(); ++i) {
+            if (xAxisLabel[i] == '\\' && i + 1 < xAxisLabel.length()) {
+                if (xAxisLabel[i+1] == '\\') {
+                    processedLabel += ' '; // Replace \\ with a space
+                    i++; // Skip the next backslash
+                } else {
+                    // Keep other escape sequences like \eta, \mu, etc.
+                    processedLabel += xAxisLabel[i];
+                }
+            } else {
+                processedLabel += xAxisLabel[i];
+            }
+        }
+
+        std::cout << "histNamePattern: " << histNamePattern
+                  << " rebinFactor: " << rebinFactor
+                  << " xAxisLabel: " << processedLabel << std::endl;
+
+        histConfigMap[histNamePattern] = {rebinFactor, processedLabel};
+    }
+
+    infile.close();
+    return histConfigMap;
+}
+
+PlotterConfig loadPlotterConfig(const std::string &colorConfigFile, const std::string &scaleConfigFile,
+                                const std::string &histConfigFile, const std::string &lumiText) {
+    PlotterConfig config;
+    config.colorMap = loadColorConfig(colorConfigFile);
+    config.scaleMap = loadScaleConfig(scaleConfigFile);
+    config.histConfigMap = loadHistConfig(histConfigFile);
+    config.lumiText = lumiText;
+    return config;
+}
+
+namespace {
+
+// Function to check if the histogram name matches a pattern
+bool matchesPattern(const std::string &histName, const std::string &pattern) {
+    return histName.find(pattern) != std::string::npos;
+}
+
+// Returns the first matching histogram config, or nullptr
+const HistConfig *findHistConfig(const std::string &histName, const std::map<std::string, HistConfig> &histConfigMap) {
+    for (const auto &configPair : histConfigMap) {
+        // Apply only the first matching pattern
+        if (matchesPattern(histName, configPair.first)) {
+            return &configPair.second;
+        }
+    }
+    return nullptr;
+}
+
+// Function to add margin to histogram max value
+double GetHistogramMaxWithMargin(TH1* hist, double marginFactor = 1.2) {
+    if (!hist) return 0;
+    double maxVal = hist->GetMaximum();
+    return maxVal * marginFactor;  // Add 20% margin
+}
+
+// Private copy of the registered parts to draw from: merged, rebinned and scaled.
+// The registered histograms themselves are never modified.
+std::unique_ptr<TH1> makeDrawHistogram(const std::vector<TH1 *> &parts, const std::string &cloneName,
+                                       const HistConfig *histConfig, double scale) {
+    if (parts.empty()) return nullptr;
+
+    std::unique_ptr<TH1> hist(static_cast<TH1 *>(parts.front()->Clone(cloneName.c_str())));
+    hist->SetDirectory(0);
+    for (size_t i = 1; i < parts.size(); ++i) {
+        hist->Add(parts[i]);
+    }
+    if (histConfig && histConfig->rebinFactor > 1) {
+        hist->Rebin(histConfig->rebinFactor);
+    }
+    if (scale != 1.0) {
+        hist->Scale(scale);
+    }
+    return hist;
+}
+
+// Integral the drawn histogram would have, computed without copying the parts.
+// Rebin() moves trailing bins that do not fill a whole group into the overflow,
+// so only the bins that survive the rebin are summed in that case.
+double scaledIntegral(const std::vector<TH1 *> &parts, const HistConfig *histConfig, double scale) {
+    double integral = 0;
+    for (TH1 *part : parts) {
+        int nBins = part->GetNbinsX();
+        int rebinFactor = histConfig ? histConfig->rebinFactor : 1;
+        if (rebinFactor > 1 && nBins % rebinFactor != 0) {
+            integral += part->Integral(1, (nBins / rebinFactor) * rebinFactor);
+        } else {
+            integral += part->Integral();
+        }
+    }
+    return scale * integral;
+}
+
+// Library owned style, built once so the caller's styles are never replaced
+TStyle *getPlotterStyle() {
+    TStyle *style = gROOT->GetStyle("SSBPlotterStyle");
+    if (!style) {
+        style = setTDRStyle("SSBPlotterStyle");
+        style->SetOptStat(0);
+    }
+    return style;
+}
+
+// Restores the caller's gStyle and batch mode when Render() returns
+class GlobalStateGuard {
+public:
+    explicit GlobalStateGuard(bool batchMode) : style_(gStyle), batch_(gROOT->IsBatch()) {
+        if (batchMode) gROOT->SetBatch(kTRUE);
+    }
+    ~GlobalStateGuard() {
+        gROOT->SetBatch(batch_);
+        if (style_) style_->cd();
+    }
+
+private:
+    TStyle *style_;
+    bool batch_;
+};
+
+} // namespace
+
+SSBPlotter::SSBPlotter(const PlotterConfig &config) : config_(config) {}
+
+void SSBPlotter::AddHistogram(const std::string &sampleName, TH1 &hist) {
+    std::string histName = hist.GetName();
+    if (sampleName == "Data") {
+        dataHistograms_[histName].push_back(&hist);
+    } else {
+        histograms_[sampleName][histName].push_back(&hist);
+    }
+}
+
+void SSBPlotter::Clear() {
+    histograms_.clear();
+    dataHistograms_.clear();
+}
+
+std::vector<std::string> SSBPlotter::GetHistogramNames() const {
+    std::vector<std::string> histNames;
+    if (histograms_.empty()) return histNames;
+
+    // Plots are driven by the histograms of the first MC sample
+    for (const auto &histPair : histograms_.begin()->second) {
+        histNames.push_back(histPair.first);
+    }
+    return histNames;
+}
+
+std::map<std::string, double> SSBPlotter::Yields(const std::string &histName) const {
+    std::map<std::string, double> yields;
+    const HistConfig *histConfig = findHistConfig(histName, config_.histConfigMap);
+
+    for (const auto &samplePair : histograms_) {
+        auto histIt = samplePair.second.find(histName);
+        if (histIt == samplePair.second.end()) continue;
+
+        auto scaleIt = config_.scaleMap.find(samplePair.first);
+        double scale = scaleIt != config_.scaleMap.end() ? scaleIt->second : 1.0;
+        yields[samplePair.first] = scaledIntegral(histIt->second, histConfig, scale);
+    }
+
+    auto dataIt = dataHistograms_.find(histName);
+    if (dataIt != dataHistograms_.end()) {
+        yields["Data"] = scaledIntegral(dataIt->second, histConfig, 1.0);
+    }
+    return yields;
+}
+
+void SSBPlotter::Render(const std::string &outputDir) const {
+    // Apply CMS TDR Style to the plotter's own canvases only
+    GlobalStateGuard guard(config_.batchMode);
+    getPlotterStyle()->cd();
+
+    if (histograms_.empty()) {
+        std::cerr << "Error: No MC histograms to plot." << std::endl;
+        return;
+    }
+
+    // Create output directory
+    std::cout << "outputDir :" << outputDir << std::endl;
+    if (gSystem->AccessPathName(outputDir.c_str()) && gSystem->mkdir(outputDir.c_str(), kTRUE) != 0) {
+        std::cerr << "Error: Could not create output directory " << outputDir << std::endl;
+        return;
+    }
+
+    std::string outputFileName = outputDir + "/Integral.txt";
+    std::ofstream integralFile(outputFileName.c_str());
+    if (!integralFile.is_open()) {
+        std::cerr << "Error: Could not open output file for integrals." << std::endl;
+        return;
+    }
+
+    // Determine MC sample order first (for stacking in reverse)
+    std::vector<std::string> sampleOrder;
+    for (const auto &samplePair : histograms_) {
+        sampleOrder.push_back(samplePair.first);
+    }
+    // Process in reverse order (stacking bottom to top)
+    std::reverse(sampleOrder.begin(), sampleOrder.end());
+
+    for (const std::string &histName : GetHistogramNames()) {
+        const HistConfig *histConfig = findHistConfig(histName, config_.histConfigMap);
+        bool writeYields = !config_.yieldHistPattern.empty() && matchesPattern(histName, config_.yieldHistPattern);
+
+        // Modify canvas creation - set up for pad splitting
+        // Library owned name: TCanvas deletes any existing canvas with the same name
+        std::string canvasName = "SSBPlotter_" + histName;
+        TCanvas canvas(canvasName.c_str(), "Histogram Stacks", 1200, 1200); // Adjust to larger height
+        canvas.cd();
+
+        // Split into two pads (top: histogram, bottom: ratio)
+        // Set top pad to 70% and bottom pad to 30%
+        TPad *pad1 = new TPad("pad1", "pad1", 0, 0.3, 1, 1.0);
+        pad1->SetBottomMargin(0.02); // Reduce bottom margin of top pad
+        pad1->SetLeftMargin(0.16);
+        pad1->SetRightMargin(0.05);
+        pad1->SetTopMargin(0.1);  // Adjust top margin
+        //pad1->SetLogy(1);  // Set log scale for Y axis
+        pad1->Draw();
+
+        TPad *pad2 = new TPad("pad2", "pad2", 0, 0.0, 1, 0.3);
+        pad2->SetTopMargin(0.03); // Reduce top margin of bottom pad
+        pad2->SetBottomMargin(0.35); // Bottom margin of bottom pad (for X-axis labels)
+        pad2->SetLeftMargin(0.16);
+        pad2->SetRightMargin(0.05);
+        pad2->Draw();
+
+        // Private copies drawn on this canvas. Declared before the stack and legend,
+        // which point to them, so that those are destroyed first.
+        std::vector<std::unique_ptr<TH1>> ownedHistograms;
+
+        // Clone to compute total MC histogram
+        std::unique_ptr<TH1> mcSum;
+        std::unique_ptr<TH1> ratioHist;
+
+        auto stack = std::make_unique<THStack>(histName.c_str(), "");  // Leave title blank for CMS style
+
+        // Adjust legend size and position - widen to avoid overlap
+        auto legend = std::make_unique<TLegend>(0.6, 0.45, 0.93, 0.88);
+        legend->SetBorderSize(0);
+        legend->SetFillStyle(0);
+        legend->SetTextFont(42);
+        legend->SetTextSize(0.03); // Reduce font size
+        legend->SetMargin(0.2); // Increase left margin
+
+        if (writeYields) {
+            integralFile << histName << std::endl;
+            integralFile << std::endl;
+        }
+
+        double inteMCtotal = 0;
+
+        for (const auto &sampleName : sampleOrder) {
+            const auto &samplePair = histograms_.at(sampleName);
+
+            // Check if histName exists in samplePair (the inner map)
+            auto histIt = samplePair.find(histName);
+            if (histIt == samplePair.end()) {
+                std::cerr << "Warning: histogram " << histName << " not found for sample " << sampleName << std::endl;
+                continue;
+            }
+
+            // Check and scale if sampleName exists in scaleMap
+            double scale = 1.0;
+            auto scaleIt = config_.scaleMap.find(sampleName);
+            if (scaleIt != config_.scaleMap.end()) {
+                scale = scaleIt->second;
+            } else {
+                std::cerr << "Warning: scale not found for sample " << sampleName << std::endl;
+            }
+
+            ownedHistograms.push_back(makeDrawHistogram(histIt->second, sampleName + "_" + histName, histConfig, scale));
+            TH1 *hist = ownedHistograms.back().get();
+
+            // Create MC sum histogram (for ratio computation)
+            if (!mcSum) {
+                mcSum.reset(static_cast<TH1 *>(hist->Clone("mcSum")));
+                mcSum->SetDirectory(0);
+                mcSum->Reset();
+                if (histConfig && !histConfig->xAxisLabel.empty()) {
+                    mcSum->GetXaxis()->SetTitle(histConfig->xAxisLabel.c_str());
+                }
+            }
+
+            // Check and set color if sampleName exists in colorMap
+            auto colorIt = config_.colorMap.find(sampleName);
+            if (colorIt != config_.colorMap.end()) {
+                hist->SetLineColor(kBlack); // Use black border
+                hist->SetLineWidth(1);
+                hist->SetFillColor(colorIt->second);
+            } else {
+                std::cerr << "Warning: color not found for sample " << sampleName << std::endl;
+            }
+
+            hist->SetFillStyle(1001);
+
+            // Add to MC sum
+            mcSum->Add(hist);
+
+            stack->Add(hist);
+            // Change legend entry format - align decimal spacing
+            legend->AddEntry(hist, Form("%s (%.1f)", sampleName.c_str(), hist->Integral()), "f");
+            if (writeYields) {integralFile << sampleName << " " << hist->Integral() << std::endl;}
+            inteMCtotal += hist->Integral();
+        }
+
+        if (writeYields) {integralFile << "MCtotal:  " << inteMCtotal << std::endl;}
+
+        // Draw histogram in top pad
+        pad1->cd();
+
+        // Data histogram (rebinned only, never scaled)
+        TH1 *dataHist = nullptr;
+        auto dataIt = dataHistograms_.find(histName);
+        if (dataIt != dataHistograms_.end()) {
+            ownedHistograms.push_back(makeDrawHistogram(dataIt->second, "Data_" + histName, histConfig, 1.0));
+            dataHist = ownedHistograms.back().get();
+        }
+
+        double maxY = 0;
+
+        // Compute maximum value from MC stack
+        if (mcSum) {
+            maxY = GetHistogramMaxWithMargin(mcSum.get(), 1.2);  // Add 20% margin
+        }
+
+        // If data histogram exists, compare max value too
+        if (dataHist) {
+            double dataMax = GetHistogramMaxWithMargin(dataHist, 1.2);
+            if (dataMax > maxY) {
+                maxY = dataMax;
+            }
+        }
+
+        // Draw stack and set Y-axis range
+        stack->Draw("HIST");
+        stack->SetMaximum(maxY);  // Set maximum value
+
+        // Hide X-axis title (shown in bottom pad)
+        stack->GetXaxis()->SetLabelSize(0);
+        stack->GetXaxis()->SetTitleSize(0);
+        stack->GetYaxis()->SetTitle("Events");
+        stack->GetYaxis()->SetTitleSize(0.06);
+        stack->GetYaxis()->SetTitleOffset(1.1);
+        stack->GetYaxis()->SetLabelSize(0.05);
+
+        // If data exists, draw it
+        if (dataHist) {
+            dataHist->SetMarkerStyle(20);
+            dataHist->SetMarkerSize(1.0);
+            dataHist->SetMarkerColor(kBlack);
+            dataHist->SetLineColor(kBlack);
+            dataHist->Draw("SAME E1P");
+            legend->AddEntry(dataHist, Form("Data (%.0f)", dataHist->Integral()), "lep");
+
+            if (writeYields) {
+                integralFile << "Data  " << dataHist->Integral() << std::endl;
+                integralFile << "Frac(MC/Data)  " << inteMCtotal/dataHist->Integral() << std::endl;
+            }
+
+            if (mcSum) {
+                // Create Data/MC ratio histogram
+                ratioHist.reset(static_cast<TH1 *>(dataHist->Clone("ratioHist")));
+                ratioHist->SetDirectory(0);
+                ratioHist->SetTitle("");
+                ratioHist->Divide(mcSum.get());
+
+                // Set Y-axis range for ratio histogram
+                ratioHist->SetMinimum(0.5);  // Minimum of ratio
+                ratioHist->SetMaximum(1.5);  // Maximum of ratio
+            }
+            if (writeYields) { integralFile << std::endl;}
+        }
+
+        legend->Draw();
+
+        // Display CMS logo and text (inside pad)
+        CMS_lumi(pad1, "Preliminary", config_.lumiText.c_str());
+
+        // Draw ratio in bottom pad
+        if (ratioHist) {
+            pad2->cd();
+
+            // Set ratio histogram style
+            ratioHist->SetStats(0);
+            ratioHist->GetYaxis()->SetTitle("Data/MC");
+            ratioHist->GetYaxis()->SetTitleSize(0.12);
+            ratioHist->GetYaxis()->SetTitleOffset(0.5);
+            ratioHist->GetYaxis()->SetLabelSize(0.1);
+            ratioHist->GetYaxis()->SetNdivisions(505);
+
+            // Set X-axis label
+            ratioHist->GetXaxis()->SetLabelSize(0.12);
+            ratioHist->GetXaxis()->SetTitleSize(0.12);
+            ratioHist->GetXaxis()->SetTitleOffset(1.0);
+            ratioHist->GetXaxis()->SetTitle(mcSum->GetXaxis()->GetTitle());
+
+            // Draw ratio histogram
+            ratioHist->Draw("E1P");
+
+            // Draw baseline at ratio = 1.0
+            TLine *line = new TLine(ratioHist->GetXaxis()->GetXmin(), 1.0,
+                                   ratioHist->GetXaxis()->GetXmax(), 1.0);
+            line->SetLineStyle(2); // Dashed line
+            line->SetLineColor(kRed);
+            line->SetLineWidth(2);
+            line->Draw();
+        }
+
+        // Save file
+        //std::string outputPath = outputDir + "/" + histName + "_Log.pdf";
+        std::string outputPath = outputDir + "/" + histName + ".pdf";
+        canvas.SaveAs(outputPath.c_str());
+        //std::string outputPathPng = outputDir + "/" + histName + "_Log.png";
+        std::string outputPathPng = outputDir + "/" + histName + ".png";
+        canvas.SaveAs(outputPathPng.c_str());
+        canvas.Clear();
+    }
+    integralFile.close();
+}
+
+} // namespace ssb
@@ -0,0 +1,72 @@
+#ifndef SSBPlotter_h
+#define SSBPlotter_h
+
+#include <TH1.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ssb {
+
+// Histogram settings (rebinning and X-axis label) keyed by name pattern
+struct HistConfig {
+    int rebinFactor;
+    std::string xAxisLabel;
+};
+
+// Everything the plotter needs besides the histograms themselves.
+// Can be filled in code or parsed from the txt config files with loadPlotterConfig().
+struct PlotterConfig {
+    std::map<std::string, int> colorMap;             // sample name -> fill color
+    std::map<std::string, double> scaleMap;          // sample name -> scale factor (MC only)
+    std::map<std::string, HistConfig> histConfigMap; // histogram name pattern -> settings
+    std::string lumiText = "13 TeV";
+    std::string yieldHistPattern = "h_Num_PV";       // histograms whose yields go to Integral.txt
+    bool batchMode = true;                           // render without opening canvas windows
+};
+
+// Parsers for the existing txt formats
+std::map<std::string, int> loadColorConfig(const std::string &colorConfigFile);
+std::map<std::string, double> loadScaleConfig(const std::string &scaleConfigFile);
+std::map<std::string, HistConfig> loadHistConfig(const std::string &histConfigFile);
+PlotterConfig loadPlotterConfig(const std::string &colorConfigFile, const std::string &scaleConfigFile,
+                                const std::string &histConfigFile, const std::string &lumiText = "13 TeV");
+
+// Stacks MC samples, overlays data and draws the Data/MC ratio.
+//
+// Histograms are borrowed, not copied: the caller keeps ownership and must keep them
+// alive until the last Render()/Yields() call. The registered histograms are never
+// modified: Render() draws from private copies and Yields() reads the integrals directly.
+class SSBPlotter {
+public:
+    explicit SSBPlotter(const PlotterConfig &config);
+
+    // Register a histogram for a sample. The histogram name (GetName()) identifies the plot,
+    // the sample named "Data" is overlaid as data. Registering the same sample/name twice
+    // adds the histograms together at render time.
+    void AddHistogram(const std::string &sampleName, TH1 &hist);
+
+    // Drop all registered histograms (the histograms themselves are left untouched)
+    void Clear();
+
+    // Names of the plots that Render() would produce
+    std::vector<std::string> GetHistogramNames() const;
+
+    // Scaled integral per sample for one histogram; data is reported under "Data"
+    std::map<std::string, double> Yields(const std::string &histName) const;
+
+    // Write <outputDir>/<histName>.pdf/.png for every histogram and <outputDir>/Integral.txt.
+    // The caller's gStyle and batch mode are restored before returning.
+    void Render(const std::string &outputDir) const;
+
+    const PlotterConfig &GetConfig() const { return config_; }
+
+private:
+    PlotterConfig config_;
+    std::map<std::string, std::map<std::string, std::vector<TH1 *>>> histograms_; // sample -> name -> parts
+    std::map<std::string, std::vector<TH1 *>> dataHistograms_;                    // name -> parts
+};
+
+} // namespace ssb
+
+#endif
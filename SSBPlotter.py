@@ -0,0 +1,66 @@
+"""Thin PyROOT interface to libSSBPlotter.
+
+Lets an analysis job plot its histograms at the end of the event loop without
+writing them to disk first:
+
+    import SSBPlotter
+    plotter = SSBPlotter.Plotter("ColorConfig.txt", "ScaleConfig.txt", "HistConfig.txt",
+                                 lumi_text="59.83 fb^{-1} (13 TeV)")
+    plotter.add("TTbar_SemiLeptonic", h_DiLepMass)   # any ROOT.TH1, not copied
+    plotter.add("Data", h_DiLepMass_data)
+    plotter.render("Histograms/MyRun")
+    print(plotter.yields("h_DiLepMass"))
+
+Histograms are borrowed by reference, so keep them alive until render()/yields()
+has run.
+"""
+
+import os
+
+import ROOT
+
+_here = os.path.dirname(os.path.abspath(__file__))
+
+ROOT.gInterpreter.AddIncludePath(_here)
+if ROOT.gSystem.Load(os.path.join(_here, "libSSBPlotter.so")) < 0:
+    raise ImportError("Could not load libSSBPlotter.so, run 'make lib' in " + _here)
+ROOT.gInterpreter.Declare('#include "SSBPlotter.h"')
+
+PlotterConfig = ROOT.ssb.PlotterConfig
+HistConfig = ROOT.ssb.HistConfig
+
+
+def load_config(color_config, scale_config, hist_config, lumi_text="13 TeV"):
+    """Parse the txt config files into a PlotterConfig."""
+    return ROOT.ssb.loadPlotterConfig(color_config, scale_config, hist_config, lumi_text)
+
+
+class Plotter(object):
+    """Python side of SSBPlotter; takes a PlotterConfig or the three config file paths."""
+
+    def __init__(self, config, scale_config=None, hist_config=None, lumi_text="13 TeV"):
+        if isinstance(config, str):
+            if scale_config is None or hist_config is None:
+                raise ValueError("Plotter(color_config, scale_config, hist_config): "
+                                 "all three config file paths are required")
+            config = load_config(config, scale_config, hist_config, lumi_text)
+        self._plotter = ROOT.ssb.SSBPlotter(config)
+        # Keep Python references so the borrowed histograms outlive the C++ plotter's use
+        self._histograms = []
+
+    def add(self, sample_name, hist):
+        self._histograms.append(hist)
+        self._plotter.AddHistogram(sample_name, hist)
+
+    def clear(self):
+        self._plotter.Clear()
+        self._histograms = []
+
+    def histogram_names(self):
+        return [str(name) for name in self._plotter.GetHistogramNames()]
+
+    def yields(self, hist_name):
+        return {str(pair.first): pair.second for pair in self._plotter.Yields(hist_name)}
+
+    def render(self, output_dir):
+        self._plotter.Render(output_dir)
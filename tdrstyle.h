@@ -3,9 +3,9 @@
 
 #include "TStyle.h"
 
-// CMS TDR Style
-void setTDRStyle() {
-    TStyle *tdrStyle = new TStyle("tdrStyle","Style for P-TDR");
+// CMS TDR Style (static so a library including this does not export the symbol)
+static TStyle *setTDRStyle(const char *styleName = "tdrStyle") {
+    TStyle *tdrStyle = new TStyle(styleName,"Style for P-TDR");
 
     // For the canvas:
     tdrStyle->SetCanvasBorderMode(0);
@@ -107,6 +107,7 @@ void setTDRStyle() {
     tdrStyle->SetPaperSize(20.,20.);
 
     tdrStyle->cd();
+    return tdrStyle;
 }
 
 #endif